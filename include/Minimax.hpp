@@ -1,11 +1,32 @@
 #pragma once
 #include "GameTypes.hpp"
 
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+
 // === Minimax ===
 int evaluateBoard(const GameState& state, bool evaluatingPlayerIsPlayer1);
 std::shared_ptr<MinimaxNode> minimaxTree(GameState state, int depth, bool maximizingPlayer);
 int minimax(const GameState& state, std::vector<std::pair<int, GameState> > &movesWithStates, int depth, bool maximizingPlayer, bool evaluatingPlayerIsPlayer1);
-std::pair<int, GameState> findBestMove(const GameState& state, std::vector<std::pair<int, GameState> > &movesWithStates, int depth);
+std::pair<int, GameState> findBestMove(const GameState& state, std::vector<std::pair<int, GameState> > &movesWithStates, int depth, std::stop_token stopToken = {});
+
+// === Pondering ===
+// Szuka odpowiedzi komputera w tle, gdy gracz (człowiek) wybiera ruch
+struct Ponderer {
+    void start(std::vector<std::pair<int, GameState> > movesWithStates, int depthPlayer1, int depthPlayer2);
+    // Kończy przeszukiwanie; zwraca gotową odpowiedź komputera na ruch pitIndex, jeśli zdążyła się policzyć
+    std::optional<std::pair<int, GameState> > finish(int pitIndex);
+    ~Ponderer();
+
+private:
+    std::mutex mutex;
+    std::stop_source search;
+    int searchedMove = -1;
+    std::vector<std::pair<int, std::pair<int, GameState> > > results; // ruch gracza -> odpowiedź komputera
+    std::jthread worker;
+};
 
 
 
@@ -299,6 +299,7 @@ void simulateGame(GameConfig config, int depthPlayer1, int depthPlayer2, int num
     int totalNumberOfMoves = 0;
     int longestGame = 0;
 
+    Ponderer ponderer;
     auto start = std::chrono::high_resolution_clock::now();
     for (int i = 1; i <= numberOfGames; i++) {
         float progress = static_cast<float>(i) / static_cast<float>(numberOfGames) * 100;
@@ -309,6 +310,7 @@ void simulateGame(GameConfig config, int depthPlayer1, int depthPlayer2, int num
         int p1Score;
         int p2Score;
         bool earlyEnd = false;
+        std::optional<std::pair<int, GameState> > ponderedMove; // odpowiedź komputera policzona w tle
         while (true) {
             std::vector<std::pair<int, GameState> > movesWithStates = getAvailableMovesWithStates(state);
             if (movesWithStates.empty()) break;
@@ -340,8 +342,16 @@ void simulateGame(GameConfig config, int depthPlayer1, int depthPlayer2, int num
                 break;
             }
 
-            const auto [pitIndex, newState] = choosePit(movesWithStates, state,
-                                                        state.isPlayerOneTurn ? depthPlayer1 : depthPlayer2);
+            // Gdy gracz myśli, komputer szuka odpowiedzi na każdy jego ruch
+            const bool humanToMove = (state.isPlayerOneTurn ? config.Player1 : config.Player2) == Player::PLAYER;
+            if (humanToMove) ponderer.start(movesWithStates, depthPlayer1, depthPlayer2);
+
+            const auto [pitIndex, newState] = ponderedMove
+                                                  ? *ponderedMove
+                                                  : choosePit(movesWithStates, state,
+                                                              state.isPlayerOneTurn ? depthPlayer1 : depthPlayer2);
+            ponderedMove.reset();
+            if (humanToMove) ponderedMove = ponderer.finish(pitIndex);
             if (showBoard) {
                 std::cout << std::endl << pitIndex << std::endl;
                 printBoard(newState);
@@ -91,8 +91,9 @@ int evaluateBoard(const GameState& state, const bool evaluatingPlayerIsPlayer1)
     return static_cast<int>(score);
 }
 
-int minimax(const GameState& state, const int depth, const bool maximizingPlayer, bool evaluatingPlayerIsPlayer1) {
-    if (depth == 0 || isGameOver(state)) {
+int minimax(const GameState& state, const int depth, const bool maximizingPlayer, bool evaluatingPlayerIsPlayer1, const std::stop_token &stopToken = {}) {
+    // Przerwane przeszukiwanie - wynik i tak zostanie odrzucony
+    if (depth == 0 || stopToken.stop_requested() || isGameOver(state)) {
         return evaluateBoard(state, evaluatingPlayerIsPlayer1);
     }
 
@@ -104,26 +105,26 @@ int minimax(const GameState& state, const int depth, const bool maximizingPlayer
     if (maximizingPlayer) {
         int maxEval = std::numeric_limits<int>::min();
         for (const auto &nextState: movesWithStates | std::views::values) {
-            int eval = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == evaluatingPlayerIsPlayer1, evaluatingPlayerIsPlayer1);
+            int eval = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == evaluatingPlayerIsPlayer1, evaluatingPlayerIsPlayer1, stopToken);
             maxEval = std::max(maxEval, eval);
         }
         return maxEval;
     } else {
         int minEval = std::numeric_limits<int>::max();
         for (const auto &nextState: movesWithStates | std::views::values) {
-            int eval = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == evaluatingPlayerIsPlayer1, evaluatingPlayerIsPlayer1);
+            int eval = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == evaluatingPlayerIsPlayer1, evaluatingPlayerIsPlayer1, stopToken);
             minEval = std::min(minEval, eval);
         }
         return minEval;
     }
 }
 
-std::pair<int, GameState> findBestMove(const GameState& state, std::vector<std::pair<int, GameState> > &movesWithStates, const int depth) {
+std::pair<int, GameState> findBestMove(const GameState& state, std::vector<std::pair<int, GameState> > &movesWithStates, const int depth, const std::stop_token stopToken) {
     std::vector<std::pair<int, GameState>> bestMoves;
     int bestScore = std::numeric_limits<int>::min();
 
     for (const auto& [move, nextState] : movesWithStates) {
-        if (const int score = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == state.isPlayerOneTurn, state.isPlayerOneTurn); score > bestScore) {
+        if (const int score = minimax(nextState, depth - 1, nextState.isPlayerOneTurn == state.isPlayerOneTurn, state.isPlayerOneTurn, stopToken); score > bestScore) {
             bestScore = score;
             bestMoves.clear();
             bestMoves.emplace_back(move, nextState);
@@ -136,10 +137,61 @@ std::pair<int, GameState> findBestMove(const GameState& state, std::vector<std::
         return {-1, state}; // brak dostępnych ruchów
     }
 
-    // RNG do losowego wyboru najlepszego ruchu
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    // RNG do losowego wyboru najlepszego ruchu (osobny dla wątku ponderowania)
+    thread_local std::random_device rd;
+    thread_local std::mt19937 gen(rd());
     std::uniform_int_distribution<size_t> dist(0, bestMoves.size() - 1);
 
     return bestMoves[dist(gen)];
-}
\ No newline at end of file
+}
+void Ponderer::start(std::vector<std::pair<int, GameState> > movesWithStates, const int depthPlayer1, const int depthPlayer2) {
+    finish(-1);
+    results.clear();
+    worker = std::jthread([this, movesWithStates = std::move(movesWithStates), depthPlayer1, depthPlayer2](
+        const std::stop_token &stopToken) mutable {
+            for (auto &[move, nextState]: movesWithStates) {
+                // Szukamy tylko tam, gdzie po ruchu gracza wykonuje ruch komputer
+                const Player nextPlayer = nextState.isPlayerOneTurn ? nextState.config.Player1 : nextState.config.Player2;
+                if (nextPlayer != Player::COMPUTER || isGameOver(nextState)) continue;
+
+                auto replies = getAvailableMovesWithStates(nextState);
+                if (replies.empty()) continue;
+
+                std::stop_token searchToken;
+                {
+                    std::lock_guard lock(mutex);
+                    if (stopToken.stop_requested()) return;
+                    searchedMove = move;
+                    search = std::stop_source();
+                    searchToken = search.get_token();
+                }
+
+                auto bestMove = findBestMove(nextState, replies,
+                                             nextState.isPlayerOneTurn ? depthPlayer1 : depthPlayer2, searchToken);
+
+                std::lock_guard lock(mutex);
+                searchedMove = -1;
+                if (!searchToken.stop_requested()) results.emplace_back(move, bestMove);
+            }
+        });
+}
+
+std::optional<std::pair<int, GameState> > Ponderer::finish(const int pitIndex) {
+    if (!worker.joinable()) return std::nullopt;
+    {
+        std::lock_guard lock(mutex);
+        worker.request_stop(); // nie zaczynamy kolejnych odpowiedzi
+        // Przeszukiwanie wybranego ruchu dokańczamy, każde inne przerywamy
+        if (searchedMove != pitIndex) search.request_stop();
+    }
+    worker.join();
+
+    for (const auto &[move, bestMove]: results) {
+        if (move == pitIndex) return bestMove;
+    }
+    return std::nullopt;
+}
+
+Ponderer::~Ponderer() {
+    finish(-1);
+}